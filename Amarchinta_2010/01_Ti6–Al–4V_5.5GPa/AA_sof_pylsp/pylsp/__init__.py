@@ -14,4 +14,5 @@ from pylsp.pylsp import (Point,
                          MisesIdealPlasticsMaterial,
                          JohnsonCookPlasticsMaterial,
                          LimHuhPlasticsMaterial,
-                         TransientAnalysis, FvSchemes, FvSolution, LSP)
+                         InSituReduction,
+                         TransientAnalysis, RelaxAnalysis, FvSchemes, FvSolution, LSP)
@@ -7,6 +7,12 @@ from pylsp.bash import runBashCommand
 from pylsp.foam import runFOAMapp
 from pylsp.utils import infoRawH2, infoRawH3, infoRawC2, infoRawC3, infoLine2, infoLine3
 
+def shotBeams(laserBeam):
+    if isinstance(laserBeam, list):
+        return laserBeam
+    return [laserBeam]
+
+
 class Case():
     def __init__(self, solverDir, lsp, case, step=0):
         sitePackagesDir = path.dirname(pylspDir[0])
@@ -16,9 +22,10 @@ class Case():
         self._lsp = lsp
         self._case = case
         self._step = step
+        self._writeFormat = 'ascii'
         self._writeFields = ['D', 'epsilonP', 'epsilonPf']
         self._writeFields.extend(self.lsp.writeFields)
-        self._laserBeam = lsp.laserBeams[self._step]
+        self._setLaserBeam()
         self._makeCaseDirs(self._case)
         infoRawC2('case dir', self._caseDir)
         infoRawC2('constant dir', self._constantDir)
@@ -217,6 +224,9 @@ class Case():
         LOG = path.join(self._logsDir, appLogName + '_' + str(self._step) + logSuffix)
 
         sNumberOfProcessors = '1'
+        # OpenMP threads per process, set for serial runs as well; unset, the
+        # OpenMP runtime uses all cores
+        sOMP = 'OMP_NUM_THREADS=' + str(self._lsp.system.nThreads) + ' '
         if parallel and self._isParallel():
             noProcDirs = 0
             for procDir in listdir(CWD):
@@ -226,10 +236,18 @@ class Case():
                 sNumberOfProcessors = str(noProcDirs)
             else:
                 sNumberOfProcessors = str(self._lsp.numberOfProcessors)
+            # hybrid MPI + OpenMP runs
+            sThreads = ''
+            if self._lsp.system.nThreads > 1:
+                if self._lsp.system.MPI == 'srun':
+                    sThreads = ' --cpus-per-task=' + str(self._lsp.system.nThreads)
+                else:
+                    sThreads = ' -x OMP_NUM_THREADS'
             if self._lsp.system.MPI == 'srun':
-                APP = 'srun -n' + sNumberOfProcessors + ' ' + APP + ' -parallel'
+                APP = 'srun -n' + sNumberOfProcessors + sThreads + ' ' + APP + ' -parallel'
             else:
-                APP = self._lsp.system.MPI + ' -np ' + sNumberOfProcessors + ' ' + APP + ' -parallel'
+                APP = self._lsp.system.MPI + sThreads + ' -np ' + sNumberOfProcessors + ' ' + APP + ' -parallel'
+        APP = sOMP + APP
 
 
         infoRawH3(self._case, 'step = ' + str(self._step), 'processors = ' + sNumberOfProcessors)
@@ -347,7 +365,14 @@ class Case():
 
     def _updateLaserBeam(self):
         infoRawH2('update laser beam', 'step = ' + str(self._step), newLine=True)
-        self._laserBeam = self._lsp.laserBeams[self._step]
+        self._setLaserBeam()
+
+    def _setLaserBeam(self):
+        # single beam BCs (laserProcessingPressure) would apply the first beam
+        # of a group only, a group needs laserShotSchedulePressure
+        self._lsp.checkLaserBeams([self._step])
+        self._laserShots = shotBeams(self._lsp.laserBeams[self._step])
+        self._laserBeam = self._laserShots[0]
 
     def _topoSet(self, suffix=''):
         FOAM = self.lsp.system.foam_com
@@ -467,3 +492,11 @@ class Case():
     def laserBeam(self):
         return self._laserBeam
 
+    @property
+    def laserShots(self):
+        return self._laserShots
+
+    @property
+    def writeFormat(self):
+        return self._writeFormat
+
@@ -1,5 +1,11 @@
 def get(case):
-    if case.lsp.unstructuredApproach:
+    springback = ''
+    if case.lsp.relaxAnalysis.springback:
+        if case.lsp.unstructuredApproach:
+            raise ValueError('RelaxAnalysis.springback cannot be used with the unstructured approach')
+        solver = 'myLinearGeometryTotalDisplacement'
+        springback = '    springback      yes;\n'
+    elif case.lsp.unstructuredApproach:
         solver = 'myUnsLinearGeometry'
     else:
         solver = 'linearGeometryTotalDisplacement'
@@ -16,7 +22,7 @@ FoamFile\n\
 \n\
 solidModel ' + solver + ';\n\n' + solver + 'Coeffs\n\
 {\n\
-    infoFrequency   10;\n\
+    infoFrequency   10;\n' + springback + '\
     //nCorrectors     10000000;\n\
     //solutionTolerance 1e-10;\n\
     //alternativeTolerance 1e-10;\n\
@@ -6,8 +6,12 @@ import pylsp.case.relax.system as system
 import pylsp.case.relax.constant as constant
 
 class Relax(Case):
-    def __init__(self, solverDir, lsp):
+    def __init__(self, solverDir, lsp, resident=False):
         super().__init__(solverDir, lsp, 'RELAX')
+        self._resident = resident
+        self._writeShots = []
+        if self._resident:
+            self._writeFormat = 'binary'
         self._initWriteFields(['D', 'epsilonP', 'epsilonPf'])
         self._transCaseDir = path.join(self._solverDir, 'TRANS')
         self._transCaseConstantDir = path.join(self._transCaseDir, 'constant')
@@ -100,4 +104,36 @@ class Relax(Case):
 
     def _postSolve(self):
         for patchNormalTransfField in self.lsp.patchNormalTransfFields:
-            self._patch2cell(patchNormalTransfField, timesRange=[self._step, self._step + 1])
\ No newline at end of file
+            self._patch2cell(patchNormalTransfField, timesRange=[self._step, self._step + 1])
+
+    def solveResident(self, writeShots):
+        self._step = 0
+        self._writeShots = writeShots
+        self._updateCase(self._step, self._step + 1,
+            [
+                case.system.fvSchemes,
+                case.constant.physicsProperties,
+                case.constant.dynamicMeshDict,
+                case.constant.g,
+
+                system.fvSolution,
+                system.controlDict,
+                system.decomposeParDict,
+                system.lspShotsDict,
+                constant.solidProperties,
+                constant.mechanicalProperties
+            ])
+        self._runFoamApp(self.lsp.system.foam_com, path.join(self._lspfoamDir, 'lspShots'), parallel=True)
+
+        for step in self._writeShots:
+            self._step = step
+            self._letOnlyTheseFields(self._caseDir, self._step, self._step + 1, fields=self._writeFields)
+            self._postSolve()
+
+    @property
+    def transCaseDir(self):
+        return self._transCaseDir
+
+    @property
+    def writeShots(self):
+        return self._writeShots
@@ -3,3 +3,4 @@ from pylsp.case.relax.system.controlDict import get
 from pylsp.case.relax.system.topoSetDict import get
 from pylsp.case.relax.system.decomposeParDict import get
 from pylsp.case.relax.system.changeDictionaryDict import get
+from pylsp.case.relax.system.lspShotsDict import get
@@ -19,7 +19,7 @@ maxCo             1;\n\
 writeInterval     1;\n\
 writeControl      timeStep;\n\
 purgeWrite        0;\n\
-writeFormat       ascii;\n\
+writeFormat       ' + case.writeFormat + ';\n\
 writePrecision    7;\n\
 writeCompression  off;\n\
 timeFormat        general;\n\
@@ -0,0 +1,41 @@
+from pylsp.case.case import shotBeams
+from pylsp.case.trans.constant.laserBeamProperties import entries
+from pylsp.case.trans.constant.laserShotSchedule import shots as scheduleShots
+
+
+def get(case):
+    headerString = '\
+FoamFile\n\
+{\n\
+    version     2.0;\n\
+    format      ascii;\n\
+    class       dictionary;\n\
+    location    "system";\n\
+    object      lspShotsDict;\n\
+}\n\n'
+
+    if case.lsp.unstructuredApproach:
+        unstructured = 'yes'
+    else:
+        unstructured = 'no'
+
+    writeShots = 'writeShots ( '
+    for shot in case.writeShots:
+        writeShots += str(shot) + ' '
+    writeShots += ');\n\n'
+
+    shots = 'shots\n{\n'
+    for step in range(0, len(case.lsp.laserBeams)):
+        shots += 'shot' + str(step) + '\n{\n'
+        laserBeams = shotBeams(case.lsp.laserBeams[step])
+        shots += entries(laserBeams[0], step)
+        shots += scheduleShots(laserBeams, step)
+        shots += '}\n\n'
+    shots += '}\n'
+
+    return headerString + \
+        'transCase "' + case.transCaseDir + '";\n' + \
+        'transEndTime ' + str(case.lsp.transientAnalysis.endTime) + ';\n' + \
+        'unstructured ' + unstructured + ';\n' + \
+        'resetTransientState yes;\n\n' + \
+        writeShots + shots
@@ -1,4 +1,5 @@
 from pylsp.case.trans.constant.solidProperties import get
 from pylsp.case.trans.constant.laserBeamProperties import get
 from pylsp.case.trans.constant.mechanicalProperties import get
-from pylsp.case.trans.constant.plasticStrainVsYieldStress import get
\ No newline at end of file
+from pylsp.case.trans.constant.plasticStrainVsYieldStress import get
+from pylsp.case.trans.constant.laserShotSchedule import get
\ No newline at end of file
@@ -2,8 +2,6 @@ import pylsp
 
 
 def get(case):
-    laserBeam = case.laserBeam
-
     headerString = '\
 FoamFile\n\
 {\n\
@@ -14,6 +12,10 @@ FoamFile\n\
     object      laserBeamProperties;\n\
 }\n\n'
 
+    return headerString + entries(case.laserBeam, case.startTime)
+
+
+def entries(laserBeam, startTime):
     square  = laserBeam.spaceProfile.square[0] * laserBeam.spaceProfile.square[0]
     square += laserBeam.spaceProfile.square[1] * laserBeam.spaceProfile.square[1]
     square += laserBeam.spaceProfile.square[2] * laserBeam.spaceProfile.square[2]
@@ -57,7 +59,7 @@ FoamFile\n\
     timeProfileString = 'timeProfile ( '
     t = []
     for T in laserBeam.timeProfile.time:
-        t.append(T + case.startTime)
+        t.append(T + startTime)
     i = 0
     for pressure in laserBeam.timeProfile.pressure:
         timeProfileString = timeProfileString + '('
@@ -86,4 +88,4 @@ FoamFile\n\
     else:
         spaceProfileString += 'considerFaceNormal false;\n\n'
 
-    return headerString + spotType + startPoint + endPoint + timeProfileString + spaceProfileString + squareString
\ No newline at end of file
+    return spotType + startPoint + endPoint + timeProfileString + spaceProfileString + squareString
\ No newline at end of file
@@ -0,0 +1,28 @@
+from pylsp.case.trans.constant.laserBeamProperties import entries
+
+
+def get(case):
+    headerString = '\
+FoamFile\n\
+{\n\
+    version     2.0;\n\
+    format      ascii;\n\
+    class       dictionary;\n\
+    location    "constant";\n\
+    object      laserShotSchedule;\n\
+}\n\n'
+
+    return headerString + shots(case.laserShots, case.startTime)
+
+
+def shots(laserBeams, startTime):
+    # time profiles are relative to the shot timeOffset
+    shotsString = 'shots\n(\n'
+    for laserBeam in laserBeams:
+        shotsString += '{\n'
+        shotsString += 'timeOffset ' + str(startTime + laserBeam.timeOffset) + ';\n\n'
+        shotsString += entries(laserBeam, 0.0)
+        shotsString += '}\n'
+    shotsString += ');\n'
+
+    return shotsString
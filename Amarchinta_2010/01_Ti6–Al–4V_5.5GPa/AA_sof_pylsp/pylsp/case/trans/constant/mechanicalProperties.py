@@ -38,7 +38,8 @@ mechanical\n\
         B       ' + str(case.lsp.material.B) + ';\n\
         C       ' + str(case.lsp.material.C) + ';\n\
         n       ' + str(case.lsp.material.n) + ';\n\
-        epsDot0 ' + str(case.lsp.material.epsDot0) + ';\n'
+        epsDot0 ' + str(case.lsp.material.epsDot0) + ';\n\
+        returnMapping ' + case.lsp.material.returnMapping + ';\n'
     elif isinstance(case.lsp.material, pylsp.LimHuhPlasticsMaterial):
         answ += '\
         type linearElasticMisesPlasticLH;\n\
@@ -49,7 +50,8 @@ mechanical\n\
         q2      ' + str(case.lsp.material.q2) + ';\n\
         q3      ' + str(case.lsp.material.q3) + ';\n\
         p       ' + str(case.lsp.material.p) + ';\n\
-        epsDot0 ' + str(case.lsp.material.epsDot0) + ';\n'
+        epsDot0 ' + str(case.lsp.material.epsDot0) + ';\n\
+        returnMapping ' + case.lsp.material.returnMapping + ';\n'
 
     answ += '\
     }\n\
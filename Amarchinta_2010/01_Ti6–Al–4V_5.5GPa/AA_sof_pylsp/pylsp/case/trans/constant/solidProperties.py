@@ -4,6 +4,18 @@ def get(case):
     else:
         solver = 'myExplicitLinearGeometryTotalDisplacement'
 
+    activeRegion = 'no'
+    if case.lsp.transientAnalysis.activeRegion:
+        activeRegion = 'yes'
+
+    localTimeStepping = 'no'
+    if case.lsp.transientAnalysis.localTimeStepping:
+        localTimeStepping = 'yes'
+
+    fusedKernel = 'no'
+    if case.lsp.transientAnalysis.fusedKernel:
+        fusedKernel = 'yes'
+
     return '\
 FoamFile\n\
 {\n\
@@ -19,4 +31,8 @@ solidModel ' + solver + ';\n\n' + solver + 'Coeffs\n\
     linearBulkViscosityCoeff 0.0;\n\
     JSTScaleFactor   0.01;\n\
     numericalViscosity    eta [ 0 0 -1 0 0 0 0 ] 0.0;\n\
+    activeRegion     ' + activeRegion + ';\n\
+    localTimeStepping ' + localTimeStepping + ';\n\
+    maxTimeStepLevel ' + str(case.lsp.transientAnalysis.maxTimeStepLevel) + ';\n\
+    fusedKernel      ' + fusedKernel + ';\n\
 }'
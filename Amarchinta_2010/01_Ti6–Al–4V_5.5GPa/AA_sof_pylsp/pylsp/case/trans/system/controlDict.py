@@ -1,4 +1,11 @@
-def get(case):   
+def get(case):
+    transientAnalysis = case.lsp.transientAnalysis
+
+    # with the in-situ reduction only the end of the transient is written
+    writeInterval = transientAnalysis.writeInterval
+    if transientAnalysis.reduction is not None:
+        writeInterval = transientAnalysis.endTime
+
     return '\
 FoamFile\n\
 {\n\
@@ -16,10 +23,10 @@ stopAt            endTime;\n\
 endTime           ' + str(case.endTime) + ';\n\
 deltaT            0;\n\
 maxCo             ' + str(case.lsp.transientAnalysis.maxCo) + ';\n\
-writeInterval     ' + str(case.lsp.transientAnalysis.writeInterval) + ';\n\
+writeInterval     ' + str(writeInterval) + ';\n\
 writeControl      adjustableRunTime;\n\
 purgeWrite        0;\n\
-writeFormat       ascii;\n\
+writeFormat       ' + case.writeFormat + ';\n\
 writePrecision    7;\n\
 writeCompression  off;\n\
 timeFormat        general;\n\
@@ -29,4 +36,40 @@ runTimeModifiable yes;\n\
 InfoSwitches\n\
 {\n\
     allowSystemOperations 1;\n\
-}'
+}\n' + functions(case)
+
+
+def functions(case):
+    reduction = case.lsp.transientAnalysis.reduction
+    if reduction is None:
+        return ''
+
+    sampleInterval = reduction.sampleInterval
+    if sampleInterval is None:
+        sampleInterval = case.lsp.transientAnalysis.writeInterval
+
+    profileInterval = reduction.profileInterval
+    if profileInterval is None:
+        profileInterval = sampleInterval
+
+    startPoint = case.laserBeam.startPoint
+    endPoint = case.laserBeam.endPoint
+
+    return '\n\
+functions\n\
+{\n\
+    lspReduction\n\
+    {\n\
+        type                    lspReduction;\n\
+        origin                  ( ' + str(startPoint.x) + ' ' + str(startPoint.y) + ' ' + str(startPoint.z) + ' );\n\
+        direction               ( ' + str(endPoint.x - startPoint.x) + ' ' + str(endPoint.y - startPoint.y) + ' ' + str(endPoint.z - startPoint.z) + ' );\n\
+        radius                  ' + str(reduction.radius) + ';\n\
+        depth                   ' + str(reduction.depth) + ';\n\
+        nBins                   ' + str(reduction.nBins) + ';\n\
+        sampleInterval          ' + str(sampleInterval) + ';\n\
+        profileInterval         ' + str(profileInterval) + ';\n\
+        plasticStrainThreshold  ' + str(reduction.plasticStrainThreshold) + ';\n\
+        rho                     ' + str(case.lsp.material.rho) + ';\n\
+        writeFields             ' + ('yes' if reduction.writeFields else 'no') + ';\n\
+    }\n\
+}\n'
@@ -6,8 +6,11 @@ import pylsp.case.trans.system as system
 import pylsp.case.trans.constant as constant
 
 class Trans(Case):
-    def __init__(self, solverDir, lsp):
+    def __init__(self, solverDir, lsp, resident=False):
         super().__init__(solverDir, lsp, 'TRANS')
+        self._resident = resident
+        if self._resident:
+            self._writeFormat = 'binary'
         self._initWriteFields(['D', 'epsilonP', 'epsilonPf'])
         self._relaxCaseDir = path.join(self._solverDir, 'RELAX')
         self._relaxCaseConstantDir = path.join(self._relaxCaseDir, 'constant')
@@ -21,7 +24,8 @@ class Trans(Case):
             self._manipulateFilesFromCaseToCase(self._relaxCaseDir, '0', self._caseDir, '0', files=['D'], operation=copyfile)
             return
 
-        if not self._isParallel():
+        # the resident driver runs the subproblem on the relax decomposition
+        if not self._isParallel() or self._resident:
             return
 
         self._updateCase(self._step, self._step + self._lsp.transientAnalysis.endTime,
@@ -174,6 +178,7 @@ class Trans(Case):
                 system.decomposeParDict_SCOTCH,
                 constant.solidProperties,
                 constant.laserBeamProperties,
+                constant.laserShotSchedule,
                 constant.mechanicalProperties,
                 constant.plasticStrainVsYieldStress,
             ])
@@ -190,3 +195,12 @@ class Trans(Case):
     def _postSolve(self):
         for patchNormalTransfField in self.lsp.patchNormalTransfFields:
             self._patch2cell(patchNormalTransfField, timesRange=[self._step, self._step + 1])
+
+    def prepareResident(self):
+        self._step = 0
+        self._preSolve()
+
+    def postSolveResident(self, step):
+        self._step = step
+        self._letOnlyTheseFields(self._caseDir, self._step, self._step + 1, fields=self._writeFields)
+        self._postSolve()
@@ -147,7 +147,7 @@ class ExponentialLaserSpaceProfile(LaserSpaceProfile):
 
 
 class LaserBeam:
-    def __init__(self, *, startPoint=None, endPoint=None, timeProfile=None, spaceProfile=None):
+    def __init__(self, *, startPoint=None, endPoint=None, timeProfile=None, spaceProfile=None, timeOffset=0.0):
         if isinstance(startPoint, Point):
             self._startPoint = startPoint
         else:
@@ -168,6 +168,13 @@ class LaserBeam:
         else:
             raise TypeError ('LaserBeam.spaceProfile has to be instance of LaserSpaceProfile')
 
+        # delay of the shot within its step, only used by the
+        # laserShotSchedulePressure boundary condition
+        if isinstance(timeOffset, (int, float)) and not isinstance(timeOffset, bool) and timeOffset >= 0.0:
+            self._timeOffset = float(timeOffset)
+        else:
+            raise TypeError ('LaserBeam.timeOffset has to be non-negative float')
+
     @property
     def startPoint(self):
         return self._startPoint
@@ -184,12 +191,17 @@ class LaserBeam:
     def spaceProfile(self):
         return self._spaceProfile
 
+    @property
+    def timeOffset(self):
+        return self._timeOffset
+
 class System:
-    def __init__(self, *, foam_org=None, foam_com=None, foam_extend=None, MPI='mpirun'):
+    def __init__(self, *, foam_org=None, foam_com=None, foam_extend=None, MPI='mpirun', nThreads=1):
         self._foam_org = foam_org
         self._foam_com = foam_com
         self._foam_extend = foam_extend
         self._MPI = MPI # 'mpirun' for spejbl | 'srun' for kraken
+        self._nThreads = int(nThreads) # OpenMP threads per MPI rank
 
     @property
     def foam_org(self):
@@ -207,12 +219,90 @@ class System:
     def MPI(self):
         return self._MPI
 
+    @property
+    def nThreads(self):
+        return self._nThreads
+
+class InSituReduction:
+    def __init__(self, *, radius=None, depth=None, nBins=100, sampleInterval=None, profileInterval=None, plasticStrainThreshold=1e-4, writeFields=False):
+        self._radius = float(radius)
+        self._depth = float(depth)
+        self._nBins = int(nBins)
+
+        if self._radius <= 0.0 or self._depth <= 0.0 or self._nBins < 1:
+            raise ValueError('InSituReduction.radius, InSituReduction.depth and InSituReduction.nBins have to be positive')
+
+        # None: TransientAnalysis.writeInterval (sampleInterval), sampleInterval (profileInterval)
+        self._sampleInterval = None if sampleInterval is None else float(sampleInterval)
+        self._profileInterval = None if profileInterval is None else float(profileInterval)
+        self._plasticStrainThreshold = float(plasticStrainThreshold)
+
+        if isinstance(writeFields, bool):
+            self._writeFields = writeFields
+        else:
+            raise TypeError('InSituReduction.writeFields has to be bool')
+
+    @property
+    def radius(self):
+        return self._radius
+
+    @property
+    def depth(self):
+        return self._depth
+
+    @property
+    def nBins(self):
+        return self._nBins
+
+    @property
+    def sampleInterval(self):
+        return self._sampleInterval
+
+    @property
+    def profileInterval(self):
+        return self._profileInterval
+
+    @property
+    def plasticStrainThreshold(self):
+        return self._plasticStrainThreshold
+
+    @property
+    def writeFields(self):
+        return self._writeFields
+
+
 class TransientAnalysis:
-    def __init__(self, *, endTime=None, maxCo=None, writeInterval=None):
+    def __init__(self, *, endTime=None, maxCo=None, writeInterval=None, activeRegion=False, localTimeStepping=False, maxTimeStepLevel=3, fusedKernel=False, reduction=None):
         self._endTime = float(endTime)
         self._maxCo = float(maxCo)
         self._writeInterval = float(writeInterval)
 
+        if isinstance(activeRegion, bool):
+            self._activeRegion = activeRegion
+        else:
+            raise TypeError('TransientAnalysis.activeRegion has to be bool')
+
+        if isinstance(localTimeStepping, bool):
+            self._localTimeStepping = localTimeStepping
+        else:
+            raise TypeError('TransientAnalysis.localTimeStepping has to be bool')
+
+        if activeRegion and localTimeStepping:
+            raise ValueError('TransientAnalysis.activeRegion and TransientAnalysis.localTimeStepping cannot be used together')
+
+        self._maxTimeStepLevel = int(maxTimeStepLevel)
+
+        if isinstance(fusedKernel, bool):
+            self._fusedKernel = fusedKernel
+        else:
+            raise TypeError('TransientAnalysis.fusedKernel has to be bool')
+
+        # in-situ reduction: full fields are only written at the end of the transient
+        if reduction is None or isinstance(reduction, InSituReduction):
+            self._reduction = reduction
+        else:
+            raise TypeError('TransientAnalysis.reduction has to be instance of InSituReduction')
+
     @property
     def endTime(self):
         return self._endTime
@@ -225,6 +315,39 @@ class TransientAnalysis:
     def writeInterval(self):
         return self._writeInterval
 
+    @property
+    def activeRegion(self):
+        return self._activeRegion
+
+    @property
+    def localTimeStepping(self):
+        return self._localTimeStepping
+
+    @property
+    def maxTimeStepLevel(self):
+        return self._maxTimeStepLevel
+
+    @property
+    def fusedKernel(self):
+        return self._fusedKernel
+
+    @property
+    def reduction(self):
+        return self._reduction
+
+
+class RelaxAnalysis:
+    def __init__(self, *, springback=False):
+        # static elastic relaxation reusing the operator and its solvers
+        if isinstance(springback, bool):
+            self._springback = springback
+        else:
+            raise TypeError('RelaxAnalysis.springback has to be bool')
+
+    @property
+    def springback(self):
+        return self._springback
+
 
 class Material:
     def __init__(self, *, rho=None, E=None, nu=None):
@@ -268,7 +391,7 @@ class MisesIdealPlasticsMaterial(Material):
 
 
 class JohnsonCookPlasticsMaterial(Material):
-    def __init__(self, *, rho=None, E=None, nu=None, A=None, B=None, C=None, n=None, epsDot0=None):
+    def __init__(self, *, rho=None, E=None, nu=None, A=None, B=None, C=None, n=None, epsDot0=None, returnMapping='classic'):
         super().__init__(rho=rho, E=E, nu=nu)
 
         if isinstance(A, float):
@@ -296,6 +419,11 @@ class JohnsonCookPlasticsMaterial(Material):
         else:
             raise TypeError('JohnsonCookPlasticsMaterial.epsDot0 has to be float')
 
+        if returnMapping in ['classic', 'batched']:
+            self._returnMapping = str(returnMapping)
+        else:
+            raise ValueError('JohnsonCookPlasticsMaterial.returnMapping has to be classic or batched')
+
     def yieldStress(self, *, epsP=0, epsPdot=0):
         answ = self._A + self._B * pow(epsP, self._n)
         answ *= (1.0 + self._C * log(max(1.0, epsPdot / self._epsDot0)))
@@ -321,9 +449,13 @@ class JohnsonCookPlasticsMaterial(Material):
     def epsDot0(self):
         return self._epsDot0
 
+    @property
+    def returnMapping(self):
+        return self._returnMapping
+
 
 class LimHuhPlasticsMaterial(Material):
-    def __init__(self, *, rho=None, E=None, nu=None, K=None, eps0=None, n=None, q1=None, q2=None, q3=None, p=None, epsDot0=None):
+    def __init__(self, *, rho=None, E=None, nu=None, K=None, eps0=None, n=None, q1=None, q2=None, q3=None, p=None, epsDot0=None, returnMapping='classic'):
         super().__init__(rho=rho, E=E, nu=nu)
 
         if isinstance(K, float):
@@ -366,6 +498,11 @@ class LimHuhPlasticsMaterial(Material):
         else:
             raise TypeError('LimHuhPlasticsMaterial.epsDot0 has to be float')
 
+        if returnMapping in ['classic', 'batched']:
+            self._returnMapping = str(returnMapping)
+        else:
+            raise ValueError('LimHuhPlasticsMaterial.returnMapping has to be classic or batched')
+
     def yieldStress(self, *, epsP=0, epsPdot=0):
         answ = self._K * pow(epsP + self._eps0, self._n)
         q = self._q1 / pow(epsP + self._q2, self._q3)
@@ -404,6 +541,10 @@ class LimHuhPlasticsMaterial(Material):
     def epsDot0(self):
         return self._epsDot0
 
+    @property
+    def returnMapping(self):
+        return self._returnMapping
+
 
 class FvSchemes:
     def __init__(self, *, gradSchemes=None, divSchemes=None, laplacianSchemes=None, snGradSchemes=None, interpolationSchemes=None):
@@ -528,7 +669,7 @@ class FvSolution:
 
 
 class LSP:
-    def __init__(self, *, numberOfProcessors=1, meshCase=None, BCfile=None, system=None, material=None, laserBeams=None, transientAnalysis=None, fvSchemes=None, fvSolution=None, writeFields=['D', 'epsilon', 'epsilonEq', 'epsilonf', 'epsilonP', 'epsilonPEq', 'epsilonPEqf', 'epsilonPf', 'sigma', 'sigmaEq', 'sigmaf', 'sigmaHyd', 'sigmaHydf'], solverDirAppendix='', patchNormalTransfFields =[]):
+    def __init__(self, *, numberOfProcessors=1, meshCase=None, BCfile=None, system=None, material=None, laserBeams=None, transientAnalysis=None, relaxAnalysis=None, fvSchemes=None, fvSolution=None, writeFields=['D', 'epsilon', 'epsilonEq', 'epsilonf', 'epsilonP', 'epsilonPEq', 'epsilonPEqf', 'epsilonPf', 'sigma', 'sigmaEq', 'sigmaf', 'sigmaHyd', 'sigmaHydf'], solverDirAppendix='', patchNormalTransfFields =[]):
         self.__version__ = '0.4.1'
         self._writeFields = writeFields
         self._numberOfProcessors = numberOfProcessors
@@ -555,18 +696,30 @@ class LSP:
                             JohnsonCookPlasticsMaterial,\
                             or LimHuhPlasticsMaterial')
 
+        # one step per item, an item is a single beam or a list of beams
+        # fired within the same transient (laserShotSchedulePressure)
         self._laserBeams = []
         for laserBeam in laserBeams:
             if isinstance(laserBeam, LaserBeam):
                 self._laserBeams.append(laserBeam)
+            elif isinstance(laserBeam, (list, tuple)) and len(laserBeam) > 0 \
+                    and all(isinstance(beam, LaserBeam) for beam in laserBeam):
+                self._laserBeams.append(list(laserBeam))
             else:
-                raise TypeError('LSP.laserBeam has to be instance of LaserBeam')
+                raise TypeError('LSP.laserBeam has to be instance of LaserBeam or list of LaserBeam')
 
         if isinstance(transientAnalysis, TransientAnalysis):
             self._transientAnalysis = transientAnalysis
         else:
             raise TypeError('LSP.transientAnalysis has to be instance of TransientAnalysis')
 
+        if relaxAnalysis is None:
+            self._relaxAnalysis = RelaxAnalysis()
+        elif isinstance(relaxAnalysis, RelaxAnalysis):
+            self._relaxAnalysis = relaxAnalysis
+        else:
+            raise TypeError('LSP.relaxAnalysis has to be instance of RelaxAnalysis')
+
         if isinstance(fvSchemes, FvSchemes):
             self._fvSchemes = fvSchemes
         else:
@@ -577,6 +730,22 @@ class LSP:
         else:
             raise TypeError('LSP.fvSolution has to be instance of FvSolution')
 
+    def checkLaserBeams(self, steps=None):
+        # a group of beams needs the laserShotSchedulePressure BC, the single
+        # beam BCs (laserProcessingPressure) would apply its first beam only
+        if steps is None:
+            steps = range(0, len(self._laserBeams))
+        for step in steps:
+            laserBeam = self._laserBeams[step]
+            if isinstance(laserBeam, list) and len(laserBeam) > 1 and not self._isShotSchedule():
+                raise ValueError('LSP.laserBeams[' + str(step) + '] has ' + str(len(laserBeam)) + ' beams, which need the laserShotSchedulePressure BC in LSP.BCfile')
+
+    def _isShotSchedule(self):
+        if self._BCfile is None or not path.isfile(self._BCfile):
+            return False
+        with open(self._BCfile) as f:
+            return 'laserShotSchedulePressure' in f.read()
+
     def _testSolverDirExists(self, solverDir):
         if path.exists(solverDir):
             infoRawH2('ANALYSIS', 'error')
@@ -640,6 +809,10 @@ class LSP:
     def transientAnalysis(self):
         return self._transientAnalysis
 
+    @property
+    def relaxAnalysis(self):
+        return self._relaxAnalysis
+
     @property
     def fvSchemes(self):
         return self._fvSchemes
@@ -654,6 +827,8 @@ class LSP:
         simulationScriptDir = path.abspath(path.dirname(argv[0]))
         solverDir = path.join(simulationScriptDir, 'solver_' + simulationScriptBaseName.split('.')[0] + self._solverDirAppendix)
 
+        self.checkLaserBeams()
+
         print()
         infoRawH3('LSP SIMUL', self.__version__, 'START', bold=True, newLine=True)
         self._testSolverDirExists(path.join(solverDir, 'RELAX'))
@@ -678,6 +853,45 @@ class LSP:
 
         infoRawH3('LSP SIMUL', self.__version__, 'END', bold=True, newLine=True)
 
+    def simulResident(self, *, writeShots=None):
+        # all shots in one lspShots process, fields written only at writeShots
+        endStep = len(self._laserBeams) - 1
+        if writeShots is None:
+            writeShots = [endStep]
+        for shot in writeShots:
+            if not isinstance(shot, int) or shot < 0 or shot > endStep:
+                raise ValueError('LSP.simulResident writeShots has to be list of shot indices in range 0 - ' + str(endStep))
+        writeShots = sorted(set(writeShots))
+
+        simulationScriptBaseName = path.basename(argv[0])
+        simulationScriptDir = path.abspath(path.dirname(argv[0]))
+        solverDir = path.join(simulationScriptDir, 'solver_' + simulationScriptBaseName.split('.')[0] + self._solverDirAppendix)
+
+        self.checkLaserBeams()
+
+        print()
+        infoRawH3('LSP SIMUL', self.__version__, 'START', bold=True, newLine=True)
+        self._testSolverDirExists(path.join(solverDir, 'RELAX'))
+        self._testSolverDirExists(path.join(solverDir, 'TRANS'))
+        try:
+            makedirs(solverDir)
+        except:
+            pass
+        copyfile(path.join(simulationScriptDir, simulationScriptBaseName), path.join(solverDir, simulationScriptBaseName))
+        self._infoBasicCaseInfo(solverDir, 0, endStep)
+
+        relax = Relax(solverDir, self, resident=True)
+        trans = Trans(solverDir, self, resident=True)
+
+        infoRawH3('ANALYSIS', 'resident', 'shots = ' + str(endStep + 1), bold=True, newLine=True)
+        trans.prepareResident()
+        relax.solveResident(writeShots)
+        for step in writeShots:
+            trans.postSolveResident(step)
+        infoRawH3('ANALYSIS', 'FINISH', str(endStep) + ' / ' + str(endStep), newLine=True)
+
+        infoRawH3('LSP SIMUL', self.__version__, 'END', bold=True, newLine=True)
+
     def simulLC(self, *, startStep, BCfile):
         endStep = startStep + 1
         simulationScriptBaseName = path.basename(argv[0])